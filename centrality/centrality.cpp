@@ -0,0 +1,381 @@
+//
+// Created by Rares Bozga on 19.10.2026.
+//
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+#include "centrality.h"
+
+// HELPERS
+
+// Runs work(thread, begin, end) for every [bounds[t], bounds[t + 1]) on its own thread.
+template<typename Work>
+static void parallelFor(const std::vector<int>& bounds, Work work) {
+    unsigned parts = bounds.size() - 1;
+    if (parts == 1) {
+        work(0, bounds[0], bounds[1]);
+        return;
+    }
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < parts; t++) {
+        pool.emplace_back(work, t, bounds[t], bounds[t + 1]);
+    }
+    for (std::thread& thread : pool) thread.join();
+}
+
+// Splits [0, count) into `parts` ranges of equal length.
+static std::vector<int> evenBounds(int count, unsigned parts) {
+    parts = std::max(1u, std::min(parts, (unsigned) std::max(count, 1)));
+    std::vector<int> bounds(parts + 1);
+    for (unsigned t = 0; t <= parts; t++) bounds[t] = (int) ((long long) count * t / parts);
+    return bounds;
+}
+
+// Splits the vertices so every range holds about the same number of edges (start is a CSR offset array).
+static std::vector<int> edgeBounds(const std::vector<int>& start, unsigned parts) {
+    int count = (int) start.size() - 1;
+    parts = std::max(1u, std::min(parts, (unsigned) std::max(count, 1)));
+    std::vector<int> bounds(parts + 1);
+    bounds[0] = 0;
+    bounds[parts] = count;
+    for (unsigned t = 1; t < parts; t++) {
+        long long target = (long long) start[count] * t / parts;
+        int at = (int) (std::lower_bound(start.begin(), start.end(), target) - start.begin());
+        bounds[t] = std::max(bounds[t - 1], std::min(at, count));
+    }
+    return bounds;
+}
+
+// SNAPSHOT
+
+GraphSnapshot::GraphSnapshot(const Graph &graph) {
+    int n = (int) graph.vertexIn.size();
+    vertices.reserve(n);
+    for (const auto &vertexPair : graph.vertexIn) vertices.push_back(vertexPair.first);
+
+    // edgeCost is sorted by (from, to), which is exactly the out CSR order
+    unsigned long m = graph.edgeCost.size();
+    outStart.assign(n + 1, 0);
+    outTo.reserve(m);
+    std::vector<int> outCost;
+    outCost.reserve(m);
+    for (const auto &edgePair : graph.edgeCost) {
+        int from = indexOf(edgePair.first.first);
+        outStart[from + 1]++;
+        outTo.push_back(indexOf(edgePair.first.second));
+        outCost.push_back(edgePair.second);
+    }
+    for (int i = 0; i < n; i++) outStart[i + 1] += outStart[i];
+
+    // in CSR by counting sort over the out edges
+    inStart.assign(n + 1, 0);
+    for (int to : outTo) inStart[to + 1]++;
+    for (int i = 0; i < n; i++) inStart[i + 1] += inStart[i];
+    inFrom.resize(m);
+    inCost.resize(m);
+    std::vector<int> next(inStart.begin(), inStart.end() - 1);
+    for (int from = 0; from < n; from++) {
+        for (int e = outStart[from]; e < outStart[from + 1]; e++) {
+            int at = next[outTo[e]]++;
+            inFrom[at] = from;
+            inCost[at] = outCost[e];
+        }
+    }
+}
+
+int GraphSnapshot::size() const {
+    return (int) vertices.size();
+}
+
+unsigned long GraphSnapshot::edges() const {
+    return outTo.size();
+}
+
+int GraphSnapshot::vertexAt(int index) const {
+    return vertices[index];
+}
+
+int GraphSnapshot::indexOf(int vertex) const {
+    auto it = std::lower_bound(vertices.begin(), vertices.end(), vertex);
+    if (it == vertices.end() || *it != vertex) return -1;
+    return (int) (it - vertices.begin());
+}
+
+// CENTRALITY
+
+Centrality::Centrality(const GraphSnapshot &snapshot, unsigned threads) : snapshot(snapshot) {
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    this->threads = std::max(1u, threads);
+}
+
+PageRankResult Centrality::pageRank(double damping, double tolerance, int maxIterations, bool weighted) const {
+    PageRankResult result;
+    int n = snapshot.size();
+    if (n == 0) {
+        result.converged = true;
+        return result;
+    }
+
+    // share of the source's rank that flows along each in edge, 0 for vertices that give nothing away
+    std::vector<double> outTotal(n, 0);
+    for (int v = 0; v < n; v++) {
+        for (int e = snapshot.inStart[v]; e < snapshot.inStart[v + 1]; e++) {
+            outTotal[snapshot.inFrom[e]] += weighted ? std::max(snapshot.inCost[e], 0) : 1;
+        }
+    }
+    std::vector<double> share(snapshot.inFrom.size());
+    for (int e = 0; e < (int) share.size(); e++) {
+        double amount = weighted ? std::max(snapshot.inCost[e], 0) : 1;
+        double total = outTotal[snapshot.inFrom[e]];
+        share[e] = total > 0 ? amount / total : 0;
+    }
+    std::vector<double> dangling(n);
+    for (int v = 0; v < n; v++) dangling[v] = outTotal[v] > 0 ? 0 : 1;
+
+    std::vector<double> rank(n, 1.0 / n);
+    std::vector<double> next(n);
+    std::vector<int> bounds = edgeBounds(snapshot.inStart, threads);
+    std::vector<double> partial(bounds.size() - 1);
+
+    const int* inStart = snapshot.inStart.data();
+    const int* inFrom = snapshot.inFrom.data();
+    const double* shareOf = share.data();
+
+    while (result.iterations < maxIterations) {
+        auto begin_time = std::chrono::steady_clock::now();
+
+        // rank held by dangling vertices
+        parallelFor(bounds, [&](unsigned t, int begin, int end) {
+            const double* r = rank.data();
+            const double* d = dangling.data();
+            double sum = 0;
+            #pragma omp simd reduction(+:sum)
+            for (int v = begin; v < end; v++) sum += r[v] * d[v];
+            partial[t] = sum;
+        });
+        double danglingRank = std::accumulate(partial.begin(), partial.end(), 0.0);
+        double base = (1 - damping) / n + damping * danglingRank / n;
+
+        // pull from in edges, then measure the change
+        parallelFor(bounds, [&](unsigned t, int begin, int end) {
+            const double* r = rank.data();
+            double* out = next.data();
+            for (int v = begin; v < end; v++) {
+                double sum = 0;
+                #pragma omp simd reduction(+:sum)
+                for (int e = inStart[v]; e < inStart[v + 1]; e++) sum += r[inFrom[e]] * shareOf[e];
+                out[v] = base + damping * sum;
+            }
+            double change = 0;
+            #pragma omp simd reduction(+:change)
+            for (int v = begin; v < end; v++) change += std::fabs(out[v] - r[v]);
+            partial[t] = change;
+        });
+        result.delta = std::accumulate(partial.begin(), partial.end(), 0.0);
+        rank.swap(next);
+
+        result.iterations++;
+        result.iterationSeconds.push_back(
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - begin_time).count());
+        if (result.delta < tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+
+    result.rank = rank;
+    return result;
+}
+
+std::vector<double> Centrality::degreeIn() const {
+    int n = snapshot.size();
+    std::vector<double> degree(n, 0);
+    double scale = n > 1 ? 1.0 / (n - 1) : 0;
+    for (int v = 0; v < n; v++) degree[v] = (snapshot.inStart[v + 1] - snapshot.inStart[v]) * scale;
+    return degree;
+}
+
+std::vector<double> Centrality::degreeOut() const {
+    int n = snapshot.size();
+    std::vector<double> degree(n, 0);
+    double scale = n > 1 ? 1.0 / (n - 1) : 0;
+    for (int v = 0; v < n; v++) degree[v] = (snapshot.outStart[v + 1] - snapshot.outStart[v]) * scale;
+    return degree;
+}
+
+std::vector<double> Centrality::closeness() const {
+    int n = snapshot.size();
+    std::vector<double> closeness(n, 0);
+    if (n < 2) return closeness;
+
+    parallelFor(evenBounds(n, threads), [&](unsigned, int begin, int end) {
+        std::vector<int> distance(n, -1);
+        std::vector<int> queue(n);
+        for (int source = begin; source < end; source++) {
+            int head = 0, tail = 0;
+            long long totalDistance = 0;
+            queue[tail++] = source;
+            distance[source] = 0;
+            while (head < tail) {
+                int v = queue[head++];
+                totalDistance += distance[v];
+                for (int e = snapshot.outStart[v]; e < snapshot.outStart[v + 1]; e++) {
+                    int w = snapshot.outTo[e];
+                    if (distance[w] < 0) {
+                        distance[w] = distance[v] + 1;
+                        queue[tail++] = w;
+                    }
+                }
+            }
+            if (totalDistance > 0) {
+                double reached = tail - 1;
+                closeness[source] = (reached / (n - 1)) * (reached / (double) totalDistance);
+            }
+            for (int i = 0; i < tail; i++) distance[queue[i]] = -1; // reset only what we touched
+        }
+    });
+    return closeness;
+}
+
+std::vector<double> Centrality::betweenness(int samples, unsigned seed) const {
+    int n = snapshot.size();
+    std::vector<double> betweenness(n, 0);
+    if (n == 0 || samples <= 0) return betweenness;
+
+    std::vector<int> sources(n);
+    std::iota(sources.begin(), sources.end(), 0);
+    if (samples < n) {
+        std::mt19937 generator(seed);
+        std::shuffle(sources.begin(), sources.end(), generator);
+        sources.resize(samples);
+    }
+    int sampled = (int) sources.size();
+
+    std::vector<int> bounds = evenBounds(sampled, threads);
+    std::vector<std::vector<double>> partial(bounds.size() - 1);
+    parallelFor(bounds, [&](unsigned t, int begin, int end) {
+        std::vector<double>& sum = partial[t];
+        sum.assign(n, 0);
+        std::vector<int> distance(n, -1);
+        std::vector<double> paths(n, 0);
+        std::vector<double> dependency(n, 0);
+        std::vector<int> order(n); // BFS order, also the queue
+        for (int i = begin; i < end; i++) {
+            int source = sources[i];
+            int head = 0, tail = 0;
+            order[tail++] = source;
+            distance[source] = 0;
+            paths[source] = 1;
+            while (head < tail) {
+                int v = order[head++];
+                for (int e = snapshot.outStart[v]; e < snapshot.outStart[v + 1]; e++) {
+                    int w = snapshot.outTo[e];
+                    if (distance[w] < 0) {
+                        distance[w] = distance[v] + 1;
+                        order[tail++] = w;
+                    }
+                    if (distance[w] == distance[v] + 1) paths[w] += paths[v];
+                }
+            }
+            // accumulate back to front, predecessors are the in neighbours one step closer
+            for (int k = tail - 1; k > 0; k--) {
+                int w = order[k];
+                for (int e = snapshot.inStart[w]; e < snapshot.inStart[w + 1]; e++) {
+                    int v = snapshot.inFrom[e];
+                    if (distance[v] >= 0 && distance[v] == distance[w] - 1) {
+                        dependency[v] += paths[v] / paths[w] * (1 + dependency[w]);
+                    }
+                }
+                sum[w] += dependency[w];
+            }
+            for (int k = 0; k < tail; k++) {
+                int v = order[k];
+                distance[v] = -1;
+                paths[v] = 0;
+                dependency[v] = 0;
+            }
+        }
+    });
+
+    double scale = (double) n / sampled;
+    for (const std::vector<double>& sum : partial) {
+        for (int v = 0; v < n; v++) betweenness[v] += sum[v] * scale;
+    }
+    return betweenness;
+}
+
+// TESTS
+void testCentrality() {
+    // 0 -> 1 -> 2 -> 0 cycle, plus 3 -> 1 and a lone vertex 4
+    Graph graph;
+    for (int i = 0; i < 5; i++) graph.addVertex(i);
+    graph.addEdge(0, 1, 1);
+    graph.addEdge(1, 2, 1);
+    graph.addEdge(2, 0, 1);
+    graph.addEdge(3, 1, 1);
+
+    GraphSnapshot snapshot(graph);
+    assert(snapshot.size() == 5);
+    assert(snapshot.edges() == 4);
+    assert(snapshot.indexOf(3) == 3);
+    assert(snapshot.indexOf(42) == -1);
+
+    for (unsigned threads : {1u, 3u}) {
+        Centrality centrality(snapshot, threads);
+
+        PageRankResult result = centrality.pageRank(0.85, 1e-9, 1000);
+        assert(result.converged);
+        assert(result.iterationSeconds.size() == result.iterations);
+        double total = std::accumulate(result.rank.begin(), result.rank.end(), 0.0);
+        assert(std::fabs(total - 1) < 1e-6);
+        assert(result.rank[1] > result.rank[0] && result.rank[1] > result.rank[3]);
+        assert(std::fabs(result.rank[3] - result.rank[4]) < 1e-9);
+
+        assert(centrality.degreeIn()[1] == 2.0 / 4);
+        assert(centrality.degreeOut()[4] == 0);
+
+        // 1 reaches 2 (1 hop) and 0 (2 hops)
+        std::vector<double> closeness = centrality.closeness();
+        assert(std::fabs(closeness[1] - (2.0 / 4) * (2.0 / 3)) < 1e-9);
+        assert(closeness[4] == 0);
+
+        // exact: 1 lies on 0->2, 3->2, 3->0; 2 on 1->0, 3->0; 0 on 2->1
+        std::vector<double> betweenness = centrality.betweenness(100);
+        assert(std::fabs(betweenness[1] - 3) < 1e-9);
+        assert(std::fabs(betweenness[2] - 2) < 1e-9);
+        assert(std::fabs(betweenness[0] - 1) < 1e-9);
+        assert(betweenness[3] == 0 && betweenness[4] == 0);
+    }
+
+    // weighted: 0 gives 3/4 of its rank to 1 and 1/4 to 2
+    Graph weightedGraph;
+    weightedGraph.addEdge(0, 1, 3);
+    weightedGraph.addEdge(0, 2, 1);
+    GraphSnapshot weightedSnapshot(weightedGraph);
+    PageRankResult weighted = Centrality(weightedSnapshot).pageRank(0.85, 1e-12, 200, true);
+    assert(weighted.converged);
+    assert(std::fabs(std::accumulate(weighted.rank.begin(), weighted.rank.end(), 0.0) - 1) < 1e-9);
+    // 0 has no in edges, so its rank is the base every vertex gets; the rest is what flowed along the edge
+    double base = weighted.rank[0];
+    assert(std::fabs((weighted.rank[1] - base) / (weighted.rank[2] - base) - 3) < 1e-9);
+
+    // weighted: 0 only has a zero cost edge and 3 only a negative one, so both count as dangling
+    Graph zeroCostGraph;
+    zeroCostGraph.addEdge(0, 1, 0);
+    zeroCostGraph.addEdge(1, 0, 5);
+    zeroCostGraph.addEdge(1, 2, 5);
+    zeroCostGraph.addEdge(3, 2, -4);
+    GraphSnapshot zeroCostSnapshot(zeroCostGraph);
+    PageRankResult zeroCost = Centrality(zeroCostSnapshot, 2).pageRank(0.85, 1e-12, 200, true);
+    assert(zeroCost.converged);
+    for (double rank : zeroCost.rank) assert(std::isfinite(rank));
+    assert(std::fabs(std::accumulate(zeroCost.rank.begin(), zeroCost.rank.end(), 0.0) - 1) < 1e-9);
+
+    std::cout << "Centrality tests passed." << std::endl;
+}
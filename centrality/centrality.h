@@ -0,0 +1,67 @@
+//
+// Created by Rares Bozga on 19.10.2026.
+//
+
+#pragma once
+
+#include <vector>
+#include "../graph/graph.h"
+
+// Contiguous (CSR) copy of a Graph. Vertices are renumbered 0..n-1 in increasing id order,
+// so the kernels below work on flat arrays instead of maps.
+class GraphSnapshot {
+    friend class Centrality;
+
+    private:
+    std::vector<int> vertices; // index -> vertex id (sorted)
+    std::vector<int> outStart; // out edges of i are outTo[outStart[i] .. outStart[i + 1])
+    std::vector<int> outTo;
+    std::vector<int> inStart; // in edges of i are inFrom[inStart[i] .. inStart[i + 1])
+    std::vector<int> inFrom;
+    std::vector<int> inCost;
+
+    public:
+    explicit GraphSnapshot(const Graph& graph);
+    [[nodiscard]] int size() const;
+    [[nodiscard]] unsigned long edges() const;
+    [[nodiscard]] int vertexAt(int index) const;
+    [[nodiscard]] int indexOf(int vertex) const; // -1 if missing
+};
+
+struct PageRankResult {
+    std::vector<double> rank; // by snapshot index, sums to 1
+    int iterations = 0;
+    bool converged = false;
+    double delta = 0; // L1 change of the last iteration
+    std::vector<double> iterationSeconds;
+};
+
+class Centrality {
+
+    private:
+    const GraphSnapshot& snapshot;
+    unsigned threads;
+
+    public:
+    // threads = 0 means one per hardware thread
+    explicit Centrality(const GraphSnapshot& snapshot, unsigned threads = 0);
+
+    // Pull based PageRank over the in edges. If weighted, a vertex splits its rank proportionally
+    // to the (non-negative part of the) edge costs instead of evenly. Dangling rank is spread uniformly.
+    [[nodiscard]] PageRankResult pageRank(double damping = 0.85, double tolerance = 1e-9,
+                                          int maxIterations = 100, bool weighted = false) const;
+
+    // degree / (n - 1)
+    [[nodiscard]] std::vector<double> degreeIn() const;
+    [[nodiscard]] std::vector<double> degreeOut() const;
+
+    // Hop distance closeness along out edges (Wasserman-Faust, handles unreachable vertices). O(V * E).
+    [[nodiscard]] std::vector<double> closeness() const;
+
+    // Brandes betweenness (hop distances) from `samples` random sources, scaled to estimate the full value.
+    // samples >= n gives the exact result.
+    [[nodiscard]] std::vector<double> betweenness(int samples, unsigned seed = 0) const;
+};
+
+// TESTS
+void testCentrality();
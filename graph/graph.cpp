@@ -3,6 +3,8 @@
 //
 
 #include <vector>
+#include <algorithm>
+#include <cassert>
 #include <iostream>
 #include <fstream>
 #include "graph.h"
@@ -22,6 +24,7 @@ bool Graph::addVertex(int who) {
     if (isVertex(who)) return false;
     vertexIn[who] = std::vector<int>();
     vertexOut[who] = std::vector<int>();
+    graphStats.onAddVertex();
     return true;
 }
 
@@ -31,6 +34,9 @@ bool Graph::isEdge(int from, int to) {
 
 bool Graph::addEdge(int from, int to, int cost) {
     if (isEdge(from, to)) return false;
+    addVertex(from); // register endpoints, keeps vertexIn / vertexOut / stats in sync
+    addVertex(to);
+    graphStats.onAddEdge(from, to, cost, vertexOut[from].size(), vertexIn[to].size());
     vertexIn[to].push_back(from);
     vertexOut[from].push_back(to);
     edgeCost[std::pair<int, int>(from, to)] = cost;
@@ -44,6 +50,8 @@ int Graph::getCost(int from, int to) {
 
 bool Graph::removeEdge(int from, int to) {
     if (!isEdge(from, to)) return false;
+    graphStats.onRemoveEdge(from, to, edgeCost[std::pair<int, int>(from, to)],
+                            vertexOut[from].size(), vertexIn[to].size());
     vertexIn[to].erase(std::find(vertexIn[to].begin(), vertexIn[to].end(), from));
     vertexOut[from].erase(std::find(vertexOut[from].begin(), vertexOut[from].end(), to));
     edgeCost.erase(std::pair<int, int>(from, to));
@@ -63,6 +71,7 @@ bool Graph::removeVertex(int who) {
     // clear from map
     vertexIn.erase(who);
     vertexOut.erase(who);
+    graphStats.onRemoveVertex();
     return true;
 }
 
@@ -76,6 +85,22 @@ std::vector<int> Graph::getVerticesIn(int to) {
     return vertexIn[to];
 }
 
+unsigned long Graph::getDegreeOut(int from) {
+    auto it = vertexOut.find(from);
+    if (it == vertexOut.end()) return 0;
+    return it->second.size();
+}
+
+unsigned long Graph::getDegreeIn(int to) {
+    auto it = vertexIn.find(to);
+    if (it == vertexIn.end()) return 0;
+    return it->second.size();
+}
+
+const GraphStats &Graph::stats() const {
+    return graphStats;
+}
+
 GraphIterator Graph::iterator() const {
     return GraphIterator(*this);
 }
@@ -266,6 +291,46 @@ void testGraph() {
     }
 }
 
+void testGraphStats() {
+    Graph graph;
+    for (int i = 0; i < 4; i++) graph.addVertex(i);
+    assert(graph.stats().vertices() == 4);
+    assert(graph.stats().edges() == 0);
+    //
+    graph.addEdge(1, 1, 10);
+    graph.addEdge(1, 2, 12);
+    graph.addEdge(1, 3, -5);
+    graph.addEdge(2, 1, 30);
+    assert(graph.stats().edges() == 4);
+    assert(graph.stats().selfLoops() == 1);
+    assert(graph.stats().totalCost() == 47);
+    assert(graph.stats().minCost() == -5);
+    assert(graph.stats().maxCost() == 30);
+    assert(graph.stats().maxDegreeOut() == 3);
+    assert(graph.stats().maxDegreeIn() == 2);
+    assert(graph.getDegreeOut(1) == 3);
+    assert(graph.getDegreeIn(1) == 2);
+    assert(graph.stats().degreeOutDistribution().at(0) == 2);
+    assert(graph.stats().density() == 4.0 / 16.0);
+    //
+    graph.removeEdge(1, 3);
+    assert(graph.stats().minCost() == 10);
+    assert(graph.stats().totalCost() == 52);
+    //
+    graph.removeVertex(1);
+    assert(graph.stats().vertices() == 3);
+    assert(graph.stats().edges() == 0);
+    assert(graph.stats().selfLoops() == 0);
+    assert(graph.stats().totalCost() == 0);
+    assert(graph.stats().maxDegreeOut() == 0);
+    assert(graph.stats().degreeInDistribution().at(0) == 3);
+    //
+    graph.addEdge(7, 8, 1); // endpoints get registered
+    assert(graph.isVertex(7) && graph.isVertex(8));
+    assert(graph.stats().vertices() == 5);
+    std::cout << "Graph stats tests passed." << std::endl;
+}
+
 void testGraphFile(const std::string& filename) {
     Graph graph;
     const clock_t begin_time = clock(); // track time
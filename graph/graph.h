@@ -5,16 +5,22 @@
 #pragma once
 
 #include <map>
+#include <string>
+#include <vector>
+#include "../stats/stats.h"
 
 class GraphIterator;
+class GraphSnapshot;
 
 class Graph {
     friend class GraphIterator;
+    friend class GraphSnapshot;
 
     private:
     std::map<int, std::vector<int>> vertexIn;
     std::map<int, std::vector<int>> vertexOut;
     std::map<std::pair<int, int>, int> edgeCost;
+    GraphStats graphStats;
 
     public:
     Graph();
@@ -27,6 +33,9 @@ class Graph {
     bool removeVertex(int who);
     std::vector<int> getVerticesOut(int from);
     std::vector<int> getVerticesIn(int to);
+    unsigned long getDegreeOut(int from);
+    unsigned long getDegreeIn(int to);
+    [[nodiscard]] const GraphStats& stats() const;
     [[nodiscard]] GraphIterator iterator() const;
 
     bool fromFile(const std::string& filename);
@@ -54,4 +63,5 @@ class GraphIterator {
 // TESTS
 void testPrintGraph();
 void testGraph();
+void testGraphStats();
 void testGraphFile(const std::string& filename);
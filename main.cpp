@@ -1,11 +1,14 @@
 #include <iostream>
 #include <vector>
 #include "graph/graph.h"
+#include "centrality/centrality.h"
 #include "ui/ui.h"
 
 int main() {
 
     //testGraph();
+    //testGraphStats();
+    //testCentrality();
     //testGraphFile("../graph1k.txt");
     //testGraphFile("../graph10k.txt");
     //testGraphFile("../graph100k.txt");
@@ -0,0 +1,98 @@
+//
+// Created by Rares Bozga on 19.10.2026.
+//
+
+#include "stats.h"
+
+void GraphStats::moveDegree(std::map<unsigned long, unsigned long> &distribution,
+                            unsigned long oldDegree, unsigned long newDegree) {
+    auto it = distribution.find(oldDegree);
+    if (--it->second == 0) distribution.erase(it);
+    distribution[newDegree]++;
+}
+
+// UPDATES
+
+void GraphStats::onAddVertex() {
+    vertexCount++;
+    degreeInCount[0]++;
+    degreeOutCount[0]++;
+}
+
+void GraphStats::onRemoveVertex() {
+    // Graph removes all edges first, so the vertex always leaves with degree 0
+    vertexCount--;
+    if (--degreeInCount[0] == 0) degreeInCount.erase(0);
+    if (--degreeOutCount[0] == 0) degreeOutCount.erase(0);
+}
+
+void GraphStats::onAddEdge(int from, int to, int cost, unsigned long oldDegreeOut, unsigned long oldDegreeIn) {
+    edgeCount++;
+    if (from == to) selfLoopCount++;
+    costSum += cost;
+    costCount[cost]++;
+    moveDegree(degreeOutCount, oldDegreeOut, oldDegreeOut + 1);
+    moveDegree(degreeInCount, oldDegreeIn, oldDegreeIn + 1);
+}
+
+void GraphStats::onRemoveEdge(int from, int to, int cost, unsigned long oldDegreeOut, unsigned long oldDegreeIn) {
+    edgeCount--;
+    if (from == to) selfLoopCount--;
+    costSum -= cost;
+    auto it = costCount.find(cost);
+    if (--it->second == 0) costCount.erase(it);
+    moveDegree(degreeOutCount, oldDegreeOut, oldDegreeOut - 1);
+    moveDegree(degreeInCount, oldDegreeIn, oldDegreeIn - 1);
+}
+
+// QUERIES
+
+unsigned long GraphStats::vertices() const {
+    return vertexCount;
+}
+
+unsigned long GraphStats::edges() const {
+    return edgeCount;
+}
+
+unsigned long GraphStats::selfLoops() const {
+    return selfLoopCount;
+}
+
+double GraphStats::density() const {
+    if (vertexCount == 0) return 0;
+    // directed graph with self loops allowed - at most n * n edges
+    return (double) edgeCount / ((double) vertexCount * (double) vertexCount);
+}
+
+long long GraphStats::totalCost() const {
+    return costSum;
+}
+
+int GraphStats::minCost() const {
+    if (costCount.empty()) return 0;
+    return costCount.begin()->first;
+}
+
+int GraphStats::maxCost() const {
+    if (costCount.empty()) return 0;
+    return costCount.rbegin()->first;
+}
+
+unsigned long GraphStats::maxDegreeIn() const {
+    if (degreeInCount.empty()) return 0;
+    return degreeInCount.rbegin()->first;
+}
+
+unsigned long GraphStats::maxDegreeOut() const {
+    if (degreeOutCount.empty()) return 0;
+    return degreeOutCount.rbegin()->first;
+}
+
+const std::map<unsigned long, unsigned long> &GraphStats::degreeInDistribution() const {
+    return degreeInCount;
+}
+
+const std::map<unsigned long, unsigned long> &GraphStats::degreeOutDistribution() const {
+    return degreeOutCount;
+}
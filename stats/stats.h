@@ -0,0 +1,43 @@
+//
+// Created by Rares Bozga on 19.10.2026.
+//
+
+#pragma once
+
+#include <map>
+
+// Graph statistics kept up to date by Graph on every mutation, so queries never iterate the graph.
+class GraphStats {
+
+    private:
+    unsigned long vertexCount = 0;
+    unsigned long edgeCount = 0;
+    unsigned long selfLoopCount = 0;
+    long long costSum = 0;
+    std::map<int, unsigned long> costCount; // cost -> how many edges have it
+    std::map<unsigned long, unsigned long> degreeInCount; // in degree -> how many vertices have it
+    std::map<unsigned long, unsigned long> degreeOutCount; // out degree -> how many vertices have it
+
+    static void moveDegree(std::map<unsigned long, unsigned long>& distribution,
+                           unsigned long oldDegree, unsigned long newDegree);
+
+    public:
+    // called by Graph
+    void onAddVertex();
+    void onRemoveVertex();
+    void onAddEdge(int from, int to, int cost, unsigned long oldDegreeOut, unsigned long oldDegreeIn);
+    void onRemoveEdge(int from, int to, int cost, unsigned long oldDegreeOut, unsigned long oldDegreeIn);
+
+    // queries
+    [[nodiscard]] unsigned long vertices() const;
+    [[nodiscard]] unsigned long edges() const;
+    [[nodiscard]] unsigned long selfLoops() const;
+    [[nodiscard]] double density() const;
+    [[nodiscard]] long long totalCost() const;
+    [[nodiscard]] int minCost() const;
+    [[nodiscard]] int maxCost() const;
+    [[nodiscard]] unsigned long maxDegreeIn() const;
+    [[nodiscard]] unsigned long maxDegreeOut() const;
+    [[nodiscard]] const std::map<unsigned long, unsigned long>& degreeInDistribution() const;
+    [[nodiscard]] const std::map<unsigned long, unsigned long>& degreeOutDistribution() const;
+};
@@ -5,6 +5,9 @@
 #include "ui.h"
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <chrono>
+#include <numeric>
 
 ui::ui() {
     this->graph = Graph();
@@ -24,7 +27,12 @@ void ui::print_all_commands() {
                  "|| vIn (to) || vOut (from) || all || degVIn (to) || degVOut (from) - "
                  "Peeks (safely) into graph data."
     << std::endl;
-    std::cout << "print - Print the entire parsed graph (NOTE: might take a while)" << std::endl << std::endl;
+    std::cout << "print - Print the entire parsed graph (NOTE: might take a while)" << std::endl;
+    std::cout << "stats || stats degIn || stats degOut - Prints graph statistics (instant, kept up to date)"
+    << std::endl;
+    std::cout << "rank pagerank (0/1 weighted) || degIn || degOut || closeness || betweenness (samples) - "
+                 "Prints the top 10 vertices by centrality (NOTE: closeness might take a while)"
+    << std::endl << std::endl;
     std::cout << "exit - See you later!" << std::endl;
 }
 
@@ -41,6 +49,17 @@ void ui::parse_args(const std::string& raw_command, std::string *into_where) {
     } while (end != -1);
 }
 
+void ui::print_top(const GraphSnapshot& snapshot, const std::vector<double>& values, int count) {
+    std::vector<int> order(values.size());
+    std::iota(order.begin(), order.end(), 0);
+    count = std::min(count, (int) order.size());
+    std::partial_sort(order.begin(), order.begin() + count, order.end(),
+                      [&values](int a, int b) { return values[a] > values[b]; });
+    for (int i = 0; i < count; i++) {
+        std::cout << snapshot.vertexAt(order[i]) << ": " << values[order[i]] << std::endl;
+    }
+}
+
 // COMMAND IMPLEMENTATION
 
 std::string ui::read_command(std::string *args) {
@@ -238,10 +257,10 @@ std::string ui::peek_command(std::string *args) {
         return "Printed all data.";
     } else if (args[1] == "degVIn") {
         int to = stoi(args[2]);
-        return "Degree In: " + std::to_string(graph.getVerticesIn(to).size());
+        return "Degree In: " + std::to_string(graph.getDegreeIn(to));
     } else if (args[1] == "degVOut") {
         int from = stoi(args[2]);
-        return "Degree Out: " + std::to_string(graph.getVerticesOut(from).size());
+        return "Degree Out: " + std::to_string(graph.getDegreeOut(from));
     }
     return "Invalid use. Please try again";
 }
@@ -251,6 +270,65 @@ std::string ui::print_command() {
     return "Done printing graph.";
 }
 
+std::string ui::stats_command(std::string *args) {
+    const GraphStats& stats = graph.stats();
+    if (args[1] == "degIn" || args[1] == "degOut") {
+        bool in = args[1] == "degIn";
+        std::cout << (in ? "Degree In" : "Degree Out") << " distribution (degree: vertices)" << std::endl;
+        for (const auto &degreePair : in ? stats.degreeInDistribution() : stats.degreeOutDistribution()) {
+            std::cout << degreePair.first << ": " << degreePair.second << std::endl;
+        }
+        return "Printed degree distribution.";
+    } else if (!args[1].empty()) {
+        return "Invalid use. Please try again";
+    }
+    std::cout << "Vertices: " << stats.vertices() << ", Edges: " << stats.edges() << std::endl;
+    std::cout << "Self loops: " << stats.selfLoops() << std::endl;
+    std::cout << "Density: " << stats.density() << std::endl;
+    std::cout << "Max Degree In: " << stats.maxDegreeIn() << ", Max Degree Out: " << stats.maxDegreeOut()
+    << std::endl;
+    std::cout << "Cost sum: " << stats.totalCost() << ", min: " << stats.minCost() << ", max: " << stats.maxCost()
+    << std::endl;
+    return "Printed graph statistics.";
+}
+
+std::string ui::rank_command(std::string *args) {
+    if (args[1] != "pagerank" && args[1] != "degIn" && args[1] != "degOut"
+        && args[1] != "closeness" && args[1] != "betweenness") {
+        return "Invalid use. Please try again";
+    }
+
+    auto begin_time = std::chrono::steady_clock::now(); // wall time, clock() would add up all threads
+    GraphSnapshot snapshot(graph);
+    Centrality centrality(snapshot);
+    float snapshot_time = std::chrono::duration<float>(std::chrono::steady_clock::now() - begin_time).count();
+    std::cout << "Snapshot of " << snapshot.size() << " vertices, " << snapshot.edges() << " edges in "
+    << snapshot_time << "s." << std::endl;
+
+    begin_time = std::chrono::steady_clock::now();
+    if (args[1] == "pagerank") {
+        bool weighted = !args[2].empty() && stoi(args[2]);
+        PageRankResult result = centrality.pageRank(0.85, 1e-9, 100, weighted);
+        for (int i = 0; i < result.iterationSeconds.size(); i++) {
+            std::cout << "Iteration " << i + 1 << ": " << result.iterationSeconds[i] << "s" << std::endl;
+        }
+        std::cout << (result.converged ? "Converged" : "Did not converge") << " after " << result.iterations
+        << " iterations (delta: " << result.delta << ")." << std::endl;
+        print_top(snapshot, result.rank, 10);
+    } else if (args[1] == "degIn") {
+        print_top(snapshot, centrality.degreeIn(), 10);
+    } else if (args[1] == "degOut") {
+        print_top(snapshot, centrality.degreeOut(), 10);
+    } else if (args[1] == "closeness") {
+        print_top(snapshot, centrality.closeness(), 10);
+    } else {
+        int samples = args[2].empty() ? 100 : stoi(args[2]);
+        print_top(snapshot, centrality.betweenness(samples), 10);
+    }
+    float end_time = std::chrono::duration<float>(std::chrono::steady_clock::now() - begin_time).count();
+    return "Ranked vertices in " + std::to_string(end_time) + "s.";
+}
+
 // MENU
 
 void ui::run() {
@@ -285,6 +363,12 @@ void ui::run() {
         else if (args[0] == "print") {
             std::cout << print_command() << std::endl;
         }
+        else if (args[0] == "stats") {
+            std::cout << stats_command(args) << std::endl;
+        }
+        else if (args[0] == "rank") {
+            std::cout << rank_command(args) << std::endl;
+        }
         else if (args[0] == "exit") {
             std::cout << "Goodbye!" << std::endl;
             break;
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../graph/graph.h"
+#include "../centrality/centrality.h"
 
 class ui {
 
@@ -13,6 +14,7 @@ private:
 
     static void print_all_commands();
     static void parse_args(const std::string& raw_command, std::string into_where[100]);
+    static void print_top(const GraphSnapshot& snapshot, const std::vector<double>& values, int count);
 
     std::string read_command(std::string args[100]);
     std::string write_command(std::string args[100]);
@@ -20,6 +22,8 @@ private:
     std::string modify_command(std::string args[100]);
     std::string peek_command(std::string args[100]);
     std::string print_command();
+    std::string stats_command(std::string args[100]);
+    std::string rank_command(std::string args[100]);
 
 public:
     ui();